@@ -2,6 +2,7 @@
 #include "lib.h"
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <float.h>
 
@@ -18,7 +19,7 @@ bool test_add_at() {
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 1, &get_result))
-    ASSERT_EQ(3, (int) get_result)
+    ASSERT_EQ(3, (int) (intptr_t) get_result)
 
     cc_array_destroy(a);
     return true;
@@ -37,11 +38,11 @@ bool test_remove() {
 
     void* remove_result;
     ASSERT_CC_OK(cc_array_remove(a, (void*) 2, &remove_result))
-    ASSERT_EQ(2, (int) remove_result)
+    ASSERT_EQ(2, (int) (intptr_t) remove_result)
     ASSERT_EQ(2, cc_array_size(a))
 
     ASSERT_CC_OK(cc_array_get_at(a, 1, &remove_result))
-    ASSERT_EQ(3, (int) remove_result)
+    ASSERT_EQ(3, (int) (intptr_t) remove_result)
 
     cc_array_destroy(a);
     return true;
@@ -60,12 +61,12 @@ bool test_replace_at() {
 
     void* replace_result;
     ASSERT_CC_OK(cc_array_replace_at(a, (void*) 4, 1, &replace_result))
-    ASSERT_EQ(2, (int) replace_result)
+    ASSERT_EQ(2, (int) (intptr_t) replace_result)
     ASSERT_EQ(3, cc_array_size(a))
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 1, &get_result))
-    ASSERT_EQ(4, (int) get_result)
+    ASSERT_EQ(4, (int) (intptr_t) get_result)
 
     cc_array_destroy(a);
     return true;
@@ -136,6 +137,44 @@ bool test_copy_shallow() {
     return true;
 }
 
+// Test that a shallow copy and its source don't see each other's changes
+bool test_copy_shallow_independent() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    for (int i = 0; i < 5; i++) {
+        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
+    }
+
+    CC_Array* shallow_copy;
+    ASSERT_CC_OK(cc_array_copy_shallow(a, &shallow_copy))
+
+    void* result;
+    ASSERT_CC_OK(cc_array_replace_at(a, (void*) 10, 0, &result))
+    ASSERT_CC_OK(cc_array_swap_at(a, 1, 2))
+    ASSERT_CC_OK(cc_array_add(a, (void*) 5))
+    cc_array_reverse(shallow_copy);
+    ASSERT_CC_OK(cc_array_remove_at(shallow_copy, 0, &result))
+
+    int expected_a[] = {10, 2, 1, 3, 4, 5};
+    ASSERT_EQ(6, cc_array_size(a))
+    for (int i = 0; i < 6; i++) {
+        ASSERT_CC_OK(cc_array_get_at(a, i, &result))
+        ASSERT_EQ(expected_a[i], (int) (intptr_t) result)
+    }
+
+    int expected_copy[] = {3, 2, 1, 0};
+    ASSERT_EQ(4, cc_array_size(shallow_copy))
+    for (int i = 0; i < 4; i++) {
+        ASSERT_CC_OK(cc_array_get_at(shallow_copy, i, &result))
+        ASSERT_EQ(expected_copy[i], (int) (intptr_t) result)
+    }
+
+    cc_array_destroy(a);
+    cc_array_destroy(shallow_copy);
+    return true;
+}
+
 // Test to sort the array
 int compare(const void* a, const void* b) {
     return (int) (intptr_t) a - (int) (intptr_t) b;
@@ -149,7 +188,7 @@ bool test_sort() {
     ASSERT_CC_OK(cc_array_add(a, (void*) 1))
     ASSERT_CC_OK(cc_array_add(a, (void*) 2))
 
-    cc_array_sort(a, compare)
+    cc_array_sort(a, compare);
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
@@ -181,7 +220,7 @@ bool test_sort_float() {
         ASSERT_CC_OK(cc_array_add(a, num))
     }
 
-    cc_array_sort(a, compare_float)
+    cc_array_sort(a, compare_float);
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
@@ -238,7 +277,7 @@ bool test_reverse() {
         ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
     }
 
-    cc_array_reverse(a)
+    cc_array_reverse(a);
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
@@ -271,7 +310,7 @@ bool test_remove_all_free() {
         ASSERT_CC_OK(cc_array_add(a, num))
     }
 
-    cc_array_remove_all_free(a)
+    cc_array_remove_all_free(a);
 
     ASSERT_EQ(0, cc_array_size(a))
 
@@ -288,7 +327,7 @@ bool test_remove_all() {
         ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
     }
 
-    cc_array_remove_all(a)
+    cc_array_remove_all(a);
     ASSERT_EQ(0, cc_array_size(a))
 
     cc_array_destroy(a);
@@ -305,10 +344,12 @@ bool test_iter_remove() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     void* get_result;
+    int steps = 0;
     while (cc_array_iter_next(&iter, &get_result) == CC_OK) {
+        ASSERT_TRUE(++steps <= 5)  // Fail fast if the iterator never ends
         if ((int) (intptr_t) get_result % 2 == 0) {
             ASSERT_CC_OK(cc_array_iter_remove(&iter, NULL))
         }
@@ -316,6 +357,12 @@ bool test_iter_remove() {
 
     ASSERT_EQ(2, cc_array_size(a))  // Only odd numbers should remain
 
+    ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
+    ASSERT_EQ(1, (int) (intptr_t) get_result)
+
+    ASSERT_CC_OK(cc_array_get_at(a, 1, &get_result))
+    ASSERT_EQ(3, (int) (intptr_t) get_result)
+
     cc_array_destroy(a);
     return true;
 }
@@ -358,7 +405,7 @@ bool test_iter_add() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     ASSERT_CC_OK(cc_array_iter_next(&iter, NULL))
     ASSERT_CC_OK(cc_array_iter_add(&iter, (void*) (intptr_t) 10))
@@ -382,7 +429,7 @@ bool test_iter_add_multiple() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     ASSERT_CC_OK(cc_array_iter_next(&iter, NULL))
     ASSERT_CC_OK(cc_array_iter_add(&iter, (void*) (intptr_t) 10))
@@ -411,7 +458,7 @@ bool test_iter_replace() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     ASSERT_CC_OK(cc_array_iter_next(&iter, NULL))
     void* replace_result;
@@ -438,7 +485,7 @@ bool test_zip_iter_next() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
@@ -475,7 +522,7 @@ bool test_zip_iter_next_different_sizes() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
@@ -491,7 +538,7 @@ bool test_zip_iter_next_different_sizes() {
     ASSERT_EQ(2, (int) (intptr_t) result1)
     ASSERT_EQ(7, (int) (intptr_t) result2)
 
-    enum cc_stat status = cc_array_zip_iter_next(&iter, &result1, &result2)
+    enum cc_stat status = cc_array_zip_iter_next(&iter, &result1, &result2);
     ASSERT_EQ(CC_ITER_END, status)
 
     cc_array_destroy(a1);
@@ -512,7 +559,7 @@ bool test_zip_iter_add() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     ASSERT_CC_OK(cc_array_zip_iter_next(&iter, NULL, NULL))
     ASSERT_CC_OK(cc_array_zip_iter_add(&iter, (void*) (intptr_t) 10, (void*) (intptr_t) 20))
@@ -545,7 +592,7 @@ bool test_zip_iter_remove() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
@@ -581,7 +628,7 @@ bool test_zip_iter_remove_extended() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
@@ -626,7 +673,7 @@ bool test_reduce() {
     }
 
     int result = 0;
-    cc_array_reduce(a, sum, &result)
+    cc_array_reduce(a, sum, &result);
     ASSERT_EQ(15, result)  // 1+2+3+4+5 = 15
 
     cc_array_destroy(a);
@@ -649,7 +696,7 @@ bool test_reduce_multiplication() {
     }
 
     int result = 1;
-    cc_array_reduce(a, multiply, &result)
+    cc_array_reduce(a, multiply, &result);
     ASSERT_EQ(120, result)  // 1*2*3*4*5 = 120
 
     cc_array_destroy(a);
@@ -672,7 +719,7 @@ bool test_reduce_subtraction() {
     }
 
     int result = 0;
-    cc_array_reduce(a, subtract, &result)
+    cc_array_reduce(a, subtract, &result);
     ASSERT_EQ(-13, result)  // (((1-2)-3)-4)-5 = -13
 
     cc_array_destroy(a);
@@ -695,7 +742,7 @@ bool test_map() {
         ASSERT_CC_OK(cc_array_add(a, num))
     }
 
-    cc_array_map(a, increment)
+    cc_array_map(a, increment);
 
     void* get_result;
     for (int i = 0; i < 5; i++) {
@@ -723,7 +770,7 @@ bool test_map_decrement() {
         ASSERT_CC_OK(cc_array_add(a, num))
     }
 
-    cc_array_map(a, decrement)
+    cc_array_map(a, decrement);
 
     void* get_result;
     for (int i = 0; i < 5; i++) {
@@ -767,6 +814,46 @@ bool test_contains_duplicates() {
     return true;
 }
 
+// Test searching an array whose size isn't a multiple of any vector width
+bool test_search_long() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    for (int i = 0; i < 37; i++) {
+        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) (i % 12)))
+    }
+    ASSERT_CC_OK(cc_array_add(a, (void*) 100))  // Only in the last slot
+
+    ASSERT_EQ(4, cc_array_contains(a, (void*) 0))  // 0, 12, 24, 36
+    ASSERT_EQ(3, cc_array_contains(a, (void*) 11))  // 11, 23, 35
+    ASSERT_EQ(1, cc_array_contains(a, (void*) 100))
+    ASSERT_EQ(0, cc_array_contains(a, (void*) 12))
+
+    size_t index;
+    ASSERT_CC_OK(cc_array_index_of(a, (void*) 5, &index))
+    ASSERT_EQ(5, index)  // First occurrence wins
+
+    ASSERT_CC_OK(cc_array_index_of(a, (void*) 100, &index))
+    ASSERT_EQ(37, index)
+
+    enum cc_stat status = cc_array_index_of(a, (void*) 12, &index);
+    ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)
+
+    void* remove_result;
+    ASSERT_CC_OK(cc_array_remove(a, (void*) 0, &remove_result))
+    ASSERT_EQ(0, (int) (intptr_t) remove_result)
+    ASSERT_EQ(37, cc_array_size(a))
+
+    ASSERT_CC_OK(cc_array_index_of(a, (void*) 0, &index))
+    ASSERT_EQ(11, index)  // Next occurrence, shifted down by one
+
+    ASSERT_CC_OK(cc_array_index_of(a, (void*) 100, &index))
+    ASSERT_EQ(36, index)
+
+    cc_array_destroy(a);
+    return true;
+}
+
 // Comparator function for test_contains_value
 int compare_int(const void* a, const void* b) {
     return (int) (intptr_t) a - (int) (intptr_t) b;
@@ -801,7 +888,7 @@ bool test_index_of() {
     ASSERT_CC_OK(cc_array_index_of(a, (void*) 3, &index))
     ASSERT_EQ(3, index)
 
-    enum cc_stat status = cc_array_index_of(a, (void*) 5, &index)
+    enum cc_stat status = cc_array_index_of(a, (void*) 5, &index);
     ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)
 
     cc_array_destroy(a);
@@ -823,7 +910,7 @@ bool test_size_capacity() {
     ASSERT_EQ(10, cc_array_size(a))
     ASSERT_TRUE(cc_array_capacity(a) > 10)
 
-    cc_array_trim_capacity(a)
+    cc_array_trim_capacity(a);
     ASSERT_EQ(10, cc_array_capacity(a))
 
     for (int i = 0; i < 5; i++) {
@@ -852,7 +939,7 @@ bool test_get_at() {
     ASSERT_CC_OK(cc_array_get_at(a, 4, &get_result))
     ASSERT_EQ(4, (int) (intptr_t) get_result)
 
-    enum cc_stat status = cc_array_get_at(a, 5, &get_result)
+    enum cc_stat status = cc_array_get_at(a, 5, &get_result);
     ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)
 
     cc_array_destroy(a);
@@ -882,7 +969,7 @@ bool test_get_last_empty() {
     ASSERT_CC_OK(cc_array_new(&a))
 
     void* last_element;
-    enum cc_stat status = cc_array_get_last(a, &last_element)
+    enum cc_stat status = cc_array_get_last(a, &last_element);
     ASSERT_EQ(CC_ERR_VALUE_NOT_FOUND, status)
 
     cc_array_destroy(a);
@@ -899,11 +986,12 @@ bool test_iterate() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     void* element;
     int count = 0;
     while (cc_array_iter_next(&iter, &element) == CC_OK) {
+        ASSERT_TRUE(count < 5)  // Fail fast if the iterator never ends
         ASSERT_EQ(count, (int) (intptr_t) element)
         count++;
     }
@@ -924,7 +1012,7 @@ bool test_iter_replace_positions() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     void* replaced_element;
     for (int i = 0; i < 5; i++) {
@@ -1005,7 +1093,7 @@ bool test_zip_iter_replace() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
@@ -1041,12 +1129,14 @@ bool test_zip_iter_index() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     void* result1;
     void* result2;
     size_t index = 0;
+    int steps = 0;
     while (cc_array_zip_iter_next(&iter, &result1, &result2) == CC_OK) {
+        ASSERT_TRUE(++steps <= 3)  // Fail fast if the iterator never ends
         index = cc_array_zip_iter_index(&iter);
     }
 
@@ -1083,27 +1173,6 @@ bool test_filter_mut() {
     return true;
 }
 
-// Comparator function for test_contains_value
-int compare_int(const void* a, const void* b) {
-    return (int) (intptr_t) a - (int) (intptr_t) b;
-}
-
-// Test to check if the array contains a specific value using comparator
-bool test_contains_value() {
-    CC_Array* a;
-    ASSERT_CC_OK(cc_array_new(&a))
-
-    for (int i = 0; i < 5; i++) {
-        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
-    }
-
-    ASSERT_EQ(1, cc_array_contains_value(a, (void*) 3, compare_int))
-    ASSERT_EQ(0, cc_array_contains_value(a, (void*) 5, compare_int))
-
-    cc_array_destroy(a);
-    return true;
-}
-
 // Test to swap elements at specific positions
 bool test_swap_at() {
     CC_Array* a;
@@ -1119,10 +1188,10 @@ bool test_swap_at() {
 
     void* get_result;
     ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
-    ASSERT_EQ(3, (int) get_result)
+    ASSERT_EQ(3, (int) (intptr_t) get_result)
 
     ASSERT_CC_OK(cc_array_get_at(a, 2, &get_result))
-    ASSERT_EQ(1, (int) get_result)
+    ASSERT_EQ(1, (int) (intptr_t) get_result)
 
     cc_array_destroy(a);
     return true;
@@ -1138,11 +1207,13 @@ bool test_iter_index() {
     }
 
     CC_ArrayIter iter;
-    cc_array_iter_init(&iter, a)
+    cc_array_iter_init(&iter, a);
 
     void* element;
     size_t index = 0;
+    int steps = 0;
     while (cc_array_iter_next(&iter, &element) == CC_OK) {
+        ASSERT_TRUE(++steps <= 5)  // Fail fast if the iterator never ends
         index = cc_array_iter_index(&iter);
     }
 
@@ -1165,7 +1236,7 @@ bool test_zip_iter_add_parallel() {
     }
 
     CC_ArrayZipIter iter;
-    cc_array_zip_iter_init(&iter, a1, a2)
+    cc_array_zip_iter_init(&iter, a1, a2);
 
     ASSERT_CC_OK(cc_array_zip_iter_next(&iter, NULL, NULL))
     ASSERT_CC_OK(cc_array_zip_iter_add(&iter, (void*) (intptr_t) 10, (void*) (intptr_t) 20))
@@ -1185,6 +1256,148 @@ bool test_zip_iter_add_parallel() {
     return true;
 }
 
+// Test adding elements at the boundaries of the valid index range
+bool test_add_at_bounds() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    enum cc_stat status = cc_array_add_at(a, (void*) 1, 1);
+    ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)  // Empty array only accepts index 0
+    ASSERT_EQ(0, cc_array_size(a))
+
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 2, 0))
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 3, 1))  // Index == size appends
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 1, 0))  // Insert at the front
+
+    status = cc_array_add_at(a, (void*) 4, 4);
+    ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)  // Index > size
+    ASSERT_EQ(3, cc_array_size(a))
+
+    void* get_result;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_CC_OK(cc_array_get_at(a, i, &get_result))
+        ASSERT_EQ(i + 1, (int) (intptr_t) get_result)
+    }
+
+    cc_array_destroy(a);
+    return true;
+}
+
+// Test removing elements at the boundaries of the valid index range
+bool test_remove_at_bounds() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
+    }
+
+    void* remove_result;
+    enum cc_stat status = cc_array_remove_at(a, 4, &remove_result);
+    ASSERT_EQ(CC_ERR_OUT_OF_RANGE, status)  // Index == size
+    ASSERT_EQ(4, cc_array_size(a))
+
+    ASSERT_CC_OK(cc_array_remove_at(a, 3, &remove_result))  // Last element
+    ASSERT_EQ(3, (int) (intptr_t) remove_result)
+
+    ASSERT_CC_OK(cc_array_remove_at(a, 0, &remove_result))  // First element
+    ASSERT_EQ(0, (int) (intptr_t) remove_result)
+    ASSERT_EQ(2, cc_array_size(a))
+
+    void* get_result;
+    ASSERT_CC_OK(cc_array_get_at(a, 0, &get_result))
+    ASSERT_EQ(1, (int) (intptr_t) get_result)
+
+    ASSERT_CC_OK(cc_array_get_at(a, 1, &get_result))
+    ASSERT_EQ(2, (int) (intptr_t) get_result)
+
+    cc_array_destroy(a);
+    return true;
+}
+
+// Test creating subarrays at the boundaries of the valid range
+bool test_subarray_bounds() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    for (int i = 0; i < 5; i++) {
+        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
+    }
+
+    CC_Array* subarray;
+    enum cc_stat status = cc_array_subarray(a, 0, 5, &subarray);
+    ASSERT_EQ(CC_ERR_INVALID_RANGE, status)  // End == size
+
+    status = cc_array_subarray(a, 3, 2, &subarray);
+    ASSERT_EQ(CC_ERR_INVALID_RANGE, status)  // Begin > end
+
+    ASSERT_CC_OK(cc_array_subarray(a, 4, 4, &subarray))  // Single element
+    ASSERT_EQ(1, cc_array_size(subarray))
+
+    void* get_result;
+    ASSERT_CC_OK(cc_array_get_at(subarray, 0, &get_result))
+    ASSERT_EQ(4, (int) (intptr_t) get_result)
+    cc_array_destroy(subarray);
+
+    ASSERT_CC_OK(cc_array_subarray(a, 0, 4, &subarray))  // Whole array
+    ASSERT_EQ(5, cc_array_size(subarray))
+
+    for (int i = 0; i < 5; i++) {
+        ASSERT_CC_OK(cc_array_get_at(subarray, i, &get_result))
+        ASSERT_EQ(i, (int) (intptr_t) get_result)
+    }
+
+    cc_array_destroy(a);
+    cc_array_destroy(subarray);
+    return true;
+}
+
+// Test a burst of inserts and removes around the same position
+bool test_add_at_remove_at_burst() {
+    CC_Array* a;
+    ASSERT_CC_OK(cc_array_new(&a))
+
+    for (int i = 0; i < 6; i++) {
+        ASSERT_CC_OK(cc_array_add(a, (void*) (intptr_t) i))
+    }
+
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 10, 3))
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 11, 4))
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 12, 3))  // Grows past DEFAULT_CAPACITY
+    ASSERT_TRUE(cc_array_capacity(a) > DEFAULT_CAPACITY)
+
+    void* remove_result;
+    ASSERT_CC_OK(cc_array_remove_at(a, 4, &remove_result))
+    ASSERT_EQ(10, (int) (intptr_t) remove_result)
+
+    ASSERT_CC_OK(cc_array_add_at(a, (void*) 13, 5))
+
+    int expected[] = {0, 1, 2, 12, 11, 13, 3, 4, 5};
+    ASSERT_EQ(9, cc_array_size(a))
+
+    void* get_result;
+    for (int i = 0; i < 9; i++) {
+        ASSERT_CC_OK(cc_array_get_at(a, i, &get_result))
+        ASSERT_EQ(expected[i], (int) (intptr_t) get_result)
+    }
+
+    CC_ArrayIter iter;
+    cc_array_iter_init(&iter, a);
+
+    size_t count = 0;
+    while (cc_array_iter_next(&iter, &get_result) == CC_OK) {
+        ASSERT_TRUE(count < 9)  // Fail fast if the iterator never ends
+        ASSERT_EQ(expected[count], (int) (intptr_t) get_result)
+        ASSERT_EQ(count, cc_array_iter_index(&iter))
+        count++;
+    }
+
+    ASSERT_EQ(9, count)
+
+    cc_array_destroy(a);
+    return true;
+}
+
 test_t TESTS[] = {
     &test_add_at,
     &test_remove,
@@ -1231,5 +1444,11 @@ test_t TESTS[] = {
     &test_iter_add_multiple,
     &test_zip_iter_next_different_sizes,
     &test_get_last_empty,
+    &test_add_at_bounds,
+    &test_remove_at_bounds,
+    &test_subarray_bounds,
+    &test_add_at_remove_at_burst,
+    &test_copy_shallow_independent,
+    &test_search_long,
     NULL
 };